@@ -47,12 +47,17 @@ typedef struct _FILE
 //  in fact, we only refer to it by its pointer
 extern char end;
 
-// The traditional errno
-int errno = 0;
+// The traditional errno. It lives in the thread's static TLS block, so
+//   nothing may set it until __main() has called _cnolib_init_tls()
+__thread int errno = 0;
 
 // Pointer to the environment, derived in __main
 char **envp;
 
+// Pointer to the ELF auxiliary vector, which the kernel places after 
+//   the environment
+static unsigned long *_auxv;
+
 // stdin, etc, FILE * initialized in __main()
 FILE *stdin, *stdout, *stderr;
 
@@ -60,6 +65,286 @@ FILE *stdin, *stdout, *stderr;
 //   call it from __main()
 extern int main (int argc, char **argv);
 
+/*===========================================================================
+
+  Startup support: static-PIE relocation and thread-local storage
+
+  A static-PIE executable is loaded at a random address, with nothing 
+  to relocate it but itself. The kernel tells us where the program 
+  headers are (AT_PHDR); from those we find the dynamic section, which 
+  lists the R_*_RELATIVE relocations that the linker could not resolve. 
+  In an ordinary static build there is no dynamic section, and nothing
+  to do.
+
+  The TLS segment (PT_TLS) is the initialization image for each thread's
+  static TLS block. The layout around the thread pointer is 
+  architecture specific: on AMD64 the block sits immediately below the
+  thread pointer, which points to a TCB whose first word points to 
+  itself; on ARM the thread pointer points to an 8-byte TCB, and the 
+  block follows it.
+
+===========================================================================*/
+#define PT_LOAD         1
+#define PT_DYNAMIC      2
+#define PT_TLS          7
+
+#define DT_NULL         0
+#define DT_RELA         7
+#define DT_RELASZ       8
+#define DT_REL          17
+#define DT_RELSZ        18
+
+#define ARCH_SET_FS     0x1002
+
+#if __WORDSIZE == 64
+typedef struct
+  {
+  unsigned int p_type;
+  unsigned int p_flags;
+  unsigned long p_offset, p_vaddr, p_paddr, p_filesz, p_memsz, p_align;
+  } _elf_phdr;
+
+typedef struct
+  {
+  unsigned long r_offset;
+  unsigned long r_info;
+  long r_addend;
+  } _elf_rela;
+
+#define _ELF_R_TYPE(info) ((info) & 0xffffffff)
+#else
+typedef struct
+  {
+  unsigned int p_type;
+  unsigned int p_offset, p_vaddr, p_paddr, p_filesz, p_memsz;
+  unsigned int p_flags;
+  unsigned int p_align;
+  } _elf_phdr;
+
+typedef struct
+  {
+  unsigned int r_offset;
+  unsigned int r_info;
+  int r_addend;
+  } _elf_rela;
+
+#define _ELF_R_TYPE(info) ((info) & 0xff)
+#endif
+
+typedef struct
+  {
+  long d_tag;
+  unsigned long d_val;
+  } _elf_dyn;
+
+#ifdef __amd64__
+#define _R_RELATIVE 8
+#endif
+#ifdef __arm__
+#define _R_RELATIVE 23
+#endif
+
+// The ELF header of this program, wherever it was loaded. The linker 
+//   defines this symbol, and because it is hidden the compiler always
+//   addresses it relative to the program counter
+extern const char __ehdr_start[] __attribute__ ((visibility ("hidden")));
+
+// The thread control block. Only the first word has a meaning defined
+//   by the ABI (and only on AMD64). ARM requires the TCB to be two words
+typedef struct _tcb
+  {
+  struct _tcb *self;
+  void *reserved;
+  } _tcb;
+
+// Location and size of the TLS initialization image
+static struct
+  {
+  const char *image;
+  size_t filesz;
+  size_t memsz;
+  size_t align;
+  } _tls;
+
+#define _ALIGN_UP(x, a) (((x) + (a) - 1) & ~((a) - 1))
+
+/*===========================================================================
+
+  getauxval 
+
+===========================================================================*/
+unsigned long getauxval (unsigned long type)
+  {
+  for (unsigned long *a = _auxv; a[0] != AT_NULL; a += 2)
+    {
+    if (a[0] == type) return a[1];
+    }
+  return 0;
+  }
+
+/*===========================================================================
+
+  _load_bias 
+
+  The difference between the address at which the program was linked,
+  and the address at which it was loaded. Always zero except for
+  static-PIE.
+
+===========================================================================*/
+static uintptr_t _load_bias (void)
+  {
+  const _elf_phdr *ph = (const _elf_phdr *) getauxval (AT_PHDR);
+  int phnum = getauxval (AT_PHNUM);
+  for (int i = 0; i < phnum; i++)
+    {
+    if (ph[i].p_type == PT_LOAD && ph[i].p_offset == 0)
+      return (uintptr_t)__ehdr_start - ph[i].p_vaddr;
+    }
+  return 0;
+  }
+
+/*===========================================================================
+
+  _cnolib_relocate 
+
+  Apply our own relative relocations. This function must not read any
+  initialized pointer (which includes string tables), or call anything
+  that does. 
+
+===========================================================================*/
+static void _cnolib_relocate (void)
+  {
+  uintptr_t base = _load_bias ();
+  const _elf_phdr *ph = (const _elf_phdr *) getauxval (AT_PHDR);
+  int phnum = getauxval (AT_PHNUM);
+
+  const _elf_dyn *dyn = NULL;
+  for (int i = 0; i < phnum; i++)
+    {
+    if (ph[i].p_type == PT_DYNAMIC)
+      dyn = (const _elf_dyn *)(base + ph[i].p_vaddr);
+    }
+  if (dyn == NULL) return;
+
+  uintptr_t rela = 0, relasz = 0, rel = 0, relsz = 0;
+  for (; dyn->d_tag != DT_NULL; dyn++)
+    {
+    switch (dyn->d_tag)
+      {
+      case DT_RELA: rela = dyn->d_val; break;
+      case DT_RELASZ: relasz = dyn->d_val; break;
+      case DT_REL: rel = dyn->d_val; break;
+      case DT_RELSZ: relsz = dyn->d_val; break;
+      }
+    }
+
+  // x86_64 uses RELA (explicit addend), ARM uses REL (addend in place) 
+  const _elf_rela *ra = (const _elf_rela *)(base + rela);
+  for (uintptr_t i = 0; rela && i < relasz / sizeof (_elf_rela); i++)
+    {
+    if (_ELF_R_TYPE (ra[i].r_info) == _R_RELATIVE)
+      *(uintptr_t *)(base + ra[i].r_offset) = base + ra[i].r_addend;
+    }
+
+  const uintptr_t *r = (const uintptr_t *)(base + rel);
+  for (uintptr_t i = 0; rel && i < relsz / (2 * sizeof (uintptr_t)); i++)
+    {
+    if (_ELF_R_TYPE (r[2 * i + 1]) == _R_RELATIVE)
+      *(uintptr_t *)(base + r[2 * i]) += base;
+    }
+  }
+
+/*===========================================================================
+
+  _tls_area_size 
+
+  The number of bytes a thread needs for its TLS block and TCB, 
+  including enough slack to align the thread pointer.
+
+===========================================================================*/
+static size_t _tls_area_size (void)
+  {
+  return _ALIGN_UP (_tls.memsz, _tls.align) + _tls.align 
+    + _ALIGN_UP (sizeof (_tcb), _tls.align);
+  }
+
+/*===========================================================================
+
+  _tls_init_area 
+
+  Lay out a TLS block and TCB in the memory at mem, which must be 
+  at least _tls_area_size() bytes. Returns the value that the thread
+  pointer must have.
+
+===========================================================================*/
+static void *_tls_init_area (void *mem)
+  {
+  #ifdef __amd64__
+  uintptr_t tp = _ALIGN_UP ((uintptr_t)mem 
+    + _ALIGN_UP (_tls.memsz, _tls.align), _tls.align);
+  char *block = (char *)tp - _ALIGN_UP (_tls.memsz, _tls.align);
+  #else
+  uintptr_t tp = _ALIGN_UP ((uintptr_t)mem, _tls.align);
+  char *block = (char *)tp + _ALIGN_UP (sizeof (_tcb), _tls.align);
+  #endif
+
+  memcpy (block, _tls.image, _tls.filesz);
+  memset (block + _tls.filesz, 0, _tls.memsz - _tls.filesz);
+
+  _tcb *tcb = (_tcb *)tp;
+  tcb->self = tcb;
+  tcb->reserved = NULL;
+  return tcb;
+  }
+
+/*===========================================================================
+
+  _set_thread_pointer 
+
+===========================================================================*/
+static int _set_thread_pointer (void *tp)
+  {
+  #ifdef __amd64__
+  return syscall (SYS_ARCH_PRCTL, ARCH_SET_FS, tp);
+  #endif
+  #ifdef __arm__
+  return syscall (SYS_SET_TLS, tp);
+  #endif
+  }
+
+/*===========================================================================
+
+  _cnolib_init_tls 
+
+  Find the TLS segment, and set up the main thread's static TLS block.
+  Failure here is fatal, because errno would be unusable.
+
+===========================================================================*/
+static void _cnolib_init_tls (void)
+  {
+  uintptr_t base = _load_bias ();
+  const _elf_phdr *ph = (const _elf_phdr *) getauxval (AT_PHDR);
+  int phnum = getauxval (AT_PHNUM);
+
+  _tls.align = sizeof (_tcb);
+  for (int i = 0; i < phnum; i++)
+    {
+    if (ph[i].p_type == PT_TLS)
+      {
+      _tls.image = (const char *)(base + ph[i].p_vaddr);
+      _tls.filesz = ph[i].p_filesz;
+      _tls.memsz = ph[i].p_memsz;
+      if (ph[i].p_align > _tls.align) _tls.align = ph[i].p_align;
+      }
+    }
+
+  void *mem = sbrk (_tls_area_size ());
+  if (mem == (void *)-1 || _set_thread_pointer (_tls_init_area (mem)) != 0)
+    {
+    syscall (SYS_EXIT, 127);
+    }
+  }
+
 /*===========================================================================
 
  __main 
@@ -74,6 +359,17 @@ int __main (int argc, char **argv)
   //   This is data that was put on the stack by the kernel
   envp = &(argv[argc + 1]);
 
+  // The auxiliary vector starts after the null that ends the environment
+  char **p = envp;
+  while (*p) p++;
+  _auxv = (unsigned long *)(p + 1);
+
+  // Until these two have been called, nothing can use a pointer that 
+  //   was initialized at link time (in a static-PIE build), or touch
+  //   a thread-local variable -- and that includes errno
+  _cnolib_relocate ();
+  _cnolib_init_tls ();
+
   // We would initialize the memory management system here, if it was
   //  sophisticated enough to need any initialization
 
@@ -220,10 +516,11 @@ int fork (void)
 ===========================================================================*/
 void exit (int status)
   {
-  syscall (SYS_EXIT, status);
+  // SYS_EXIT would end only the calling thread
+  syscall (SYS_EXIT_GROUP, status);
   // Ugh -- gcc recognizes "exit" as a "noreturn" function by default. So
   //   we have to do something that the compiler things is non-returning.
-  // This code will ever be reached, because syscall 60 terminates the
+  // This code will ever be reached, because the syscall terminates the
   //   program. However, the compiler doesn't know that.
   for(;;);
   }
@@ -425,7 +722,7 @@ size_t strspn (const char *s, const char *accept)
   strtok
 
 ===========================================================================*/
-static char *olds;
+static __thread char *olds;
 char *strtok (char *s, const char *delim)
   {
   char *token;
@@ -610,6 +907,11 @@ typedef struct free_block
 static free_block free_block_list_head = { 0, 0 };
 static const size_t align_to = 16;
 
+// The free list is shared by all threads. Locking is skipped until the 
+//   first thread is created, because until then nothing can race
+static pthread_mutex_t _malloc_lock = PTHREAD_MUTEX_INITIALIZER;
+static BOOL _threads_started = FALSE;
+
 /*===========================================================================
 
   brk 
@@ -644,6 +946,8 @@ void *malloc (size_t size)
   {
   // Align size of 16-byte boundary
   size = (size + sizeof(size_t) + (align_to - 1)) & ~ (align_to - 1);
+  BOOL locked = _threads_started;
+  if (locked) pthread_mutex_lock (&_malloc_lock);
   free_block* block = free_block_list_head.next;
   free_block** head = &(free_block_list_head.next);
   while (block != 0) 
@@ -651,6 +955,7 @@ void *malloc (size_t size)
     if (block->size >= size) 
       {
       *head = block->next;
+      if (locked) pthread_mutex_unlock (&_malloc_lock);
       return ((char*)block) + sizeof(size_t);
       }
     head = &(block->next);
@@ -659,6 +964,7 @@ void *malloc (size_t size)
 
   block = (free_block*)sbrk(size);
   block->size = size;
+  if (locked) pthread_mutex_unlock (&_malloc_lock);
 
   return ((char*)block) + sizeof(size_t);
   }
@@ -671,8 +977,58 @@ void *malloc (size_t size)
 void free (void* ptr) 
   {
   free_block* block = (free_block*)(((char*)ptr) - sizeof(size_t));
+  BOOL locked = _threads_started;
+  if (locked) pthread_mutex_lock (&_malloc_lock);
   block->next = free_block_list_head.next;
   free_block_list_head.next = block;
+  if (locked) pthread_mutex_unlock (&_malloc_lock);
+  }
+
+/*===========================================================================
+
+  mmap 
+
+===========================================================================*/
+void *mmap (void *addr, size_t length, int prot, int flags, int fd, 
+            off_t offset)
+  {
+  #ifdef __arm__
+  // mmap2 takes the offset in 4096-byte units
+  long r = syscall (SYS_MMAP2, addr, length, prot, flags, fd, offset >> 12);
+  #else
+  long r = syscall (SYS_MMAP, addr, length, prot, flags, fd, offset);
+  #endif
+  // Addresses can look negative, so only the top 4095 values are errors
+  if ((unsigned long)r > -4096UL) 
+    {
+    errno = -r;
+    return MAP_FAILED;
+    }
+  else
+    {
+    errno = 0;
+    return (void *)r;
+    }
+  }
+
+/*===========================================================================
+
+  munmap 
+
+===========================================================================*/
+int munmap (void *addr, size_t length)
+  {
+  int r = syscall (SYS_MUNMAP, addr, length);
+  if (r < 0) 
+    {
+    errno = -r;
+    return -1;
+    }
+  else
+    {
+    errno = 0;
+    return r;
+    }
   }
 
 /*===========================================================================
@@ -1297,7 +1653,7 @@ void perror (const char *message)
   strerror 
 
 ===========================================================================*/
-static char _errbuf [128];
+static __thread char _errbuf [128];
 
 char *strerror (int errnum)
   {
@@ -1356,5 +1712,335 @@ unsigned int sleep (unsigned int sec)
   return left;
   }
 
+/*===========================================================================
+
+  Threads 
+
+  Each thread gets a single anonymous mapping, laid out as the stack
+  (growing down), then the static TLS block and TCB, then the pthread
+  structure itself. The kernel writes the thread ID into the structure
+  when the thread starts, and clears it (waking any futex waiter) when
+  the thread has finished with its stack; so pthread_join() waits on 
+  that word, and can then safely unmap everything.
+
+  Mutexes are the three-state futex mutex (0 = unlocked, 1 = locked,
+  2 = locked with waiters) described in Drepper's "Futexes are tricky".
+  Condition variables wait on a sequence number that every signal 
+  increments.
+
+===========================================================================*/
+#define FUTEX_WAIT          0
+#define FUTEX_WAKE          1
+#define FUTEX_PRIVATE_FLAG  128
+
+#define _THREAD_STACK_SIZE  (1024 * 1024)
+
+#define _CLONE_THREAD_FLAGS (CLONE_VM | CLONE_FS | CLONE_FILES \
+  | CLONE_SIGHAND | CLONE_THREAD | CLONE_SYSVSEM | CLONE_SETTLS \
+  | CLONE_PARENT_SETTID | CLONE_CHILD_CLEARTID)
+
+struct _pthread
+  {
+  void *(*start) (void *);
+  void *arg;
+  void *result;
+  int tid;
+  void *map;
+  size_t map_size;
+  };
+
+// The thread's own descriptor; NULL in the main thread
+static __thread pthread_t _self;
+static struct _pthread _main_thread;
+
+/*===========================================================================
+
+  _futex_wait, _futex_wake 
+
+===========================================================================*/
+static int _futex_wait (int *addr, int val)
+  {
+  return syscall (SYS_FUTEX, addr, FUTEX_WAIT | FUTEX_PRIVATE_FLAG, val, 
+    NULL);
+  }
+
+static int _futex_wake (int *addr, int n)
+  {
+  return syscall (SYS_FUTEX, addr, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, n);
+  }
+
+/*===========================================================================
+
+  sched_yield 
+
+===========================================================================*/
+int sched_yield (void)
+  {
+  return syscall (SYS_SCHED_YIELD);
+  }
+
+/*===========================================================================
+
+  pthread_attr_init 
+
+===========================================================================*/
+int pthread_attr_init (pthread_attr_t *attr)
+  {
+  attr->stacksize = _THREAD_STACK_SIZE;
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_attr_setstacksize 
+
+===========================================================================*/
+int pthread_attr_setstacksize (pthread_attr_t *attr, size_t stacksize)
+  {
+  attr->stacksize = stacksize;
+  return 0;
+  }
+
+/*===========================================================================
+
+  _thread_start 
+
+  The first function to run in a new thread, called from __clone.
+
+===========================================================================*/
+static int _thread_start (void *arg)
+  {
+  pthread_t t = arg;
+  _self = t;
+  pthread_exit (t->start (t->arg));
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_create 
+
+  Note that POSIX thread functions return an error number, rather than
+  setting errno.
+
+===========================================================================*/
+int pthread_create (pthread_t *thread, const pthread_attr_t *attr, 
+      void *(*start_routine) (void *), void *arg)
+  {
+  size_t stacksize = attr ? attr->stacksize : _THREAD_STACK_SIZE;
+  stacksize = _ALIGN_UP (stacksize, 16);
+  size_t size = _ALIGN_UP (stacksize + _tls_area_size () 
+    + sizeof (struct _pthread), getauxval (AT_PAGESZ));
+
+  char *map = mmap (NULL, size, PROT_READ | PROT_WRITE, 
+    MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+  if (map == MAP_FAILED) return errno;
+
+  pthread_t t = (pthread_t)(map + size - sizeof (struct _pthread));
+  t->start = start_routine;
+  t->arg = arg;
+  t->result = NULL;
+  t->map = map;
+  t->map_size = size;
+  void *tp = _tls_init_area (map + stacksize);
+
+  _threads_started = TRUE;
+  int r = __clone (_thread_start, map + stacksize, _CLONE_THREAD_FLAGS, 
+    t, &t->tid, tp, &t->tid);
+  if (r < 0)
+    {
+    munmap (map, size);
+    return -r;
+    }
+
+  *thread = t;
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_join 
+
+===========================================================================*/
+int pthread_join (pthread_t thread, void **retval)
+  {
+  int tid;
+  // The kernel's wake-up on thread exit is not a private futex 
+  while ((tid = __atomic_load_n (&thread->tid, __ATOMIC_ACQUIRE)) != 0)
+    syscall (SYS_FUTEX, &thread->tid, FUTEX_WAIT, tid, NULL);
+
+  if (retval) *retval = thread->result;
+  munmap (thread->map, thread->map_size);
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_exit 
 
+===========================================================================*/
+void pthread_exit (void *retval)
+  {
+  pthread_self()->result = retval;
+  for (;;) syscall (SYS_EXIT, 0);
+  }
+
+/*===========================================================================
 
+  pthread_self 
+
+===========================================================================*/
+pthread_t pthread_self (void)
+  {
+  return _self ? _self : &_main_thread;
+  }
+
+/*===========================================================================
+
+  pthread_mutex_init, pthread_mutex_destroy 
+
+===========================================================================*/
+int pthread_mutex_init (pthread_mutex_t *mutex, const void *attr)
+  {
+  mutex->lock = 0;
+  return 0;
+  }
+
+int pthread_mutex_destroy (pthread_mutex_t *mutex)
+  {
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_mutex_lock 
+
+===========================================================================*/
+int pthread_mutex_lock (pthread_mutex_t *mutex)
+  {
+  int c = 0;
+  if (__atomic_compare_exchange_n (&mutex->lock, &c, 1, FALSE, 
+        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+    return 0;
+
+  // Contended: mark the mutex as having waiters, and sleep until 
+  //   we are the one that changes it from unlocked
+  if (c != 2) 
+    c = __atomic_exchange_n (&mutex->lock, 2, __ATOMIC_ACQUIRE);
+  while (c != 0)
+    {
+    _futex_wait (&mutex->lock, 2);
+    c = __atomic_exchange_n (&mutex->lock, 2, __ATOMIC_ACQUIRE);
+    }
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_mutex_trylock 
+
+===========================================================================*/
+int pthread_mutex_trylock (pthread_mutex_t *mutex)
+  {
+  int c = 0;
+  if (__atomic_compare_exchange_n (&mutex->lock, &c, 1, FALSE, 
+        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+    return 0;
+  return EBUSY;
+  }
+
+/*===========================================================================
+
+  pthread_mutex_unlock 
+
+===========================================================================*/
+int pthread_mutex_unlock (pthread_mutex_t *mutex)
+  {
+  if (__atomic_fetch_sub (&mutex->lock, 1, __ATOMIC_RELEASE) != 1)
+    {
+    __atomic_store_n (&mutex->lock, 0, __ATOMIC_RELEASE);
+    _futex_wake (&mutex->lock, 1);
+    }
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_cond_init, pthread_cond_destroy 
+
+===========================================================================*/
+int pthread_cond_init (pthread_cond_t *cond, const void *attr)
+  {
+  cond->seq = 0;
+  return 0;
+  }
+
+int pthread_cond_destroy (pthread_cond_t *cond)
+  {
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_cond_wait 
+
+  Spurious wake-ups are possible, as POSIX allows.
+
+===========================================================================*/
+int pthread_cond_wait (pthread_cond_t *cond, pthread_mutex_t *mutex)
+  {
+  int seq = __atomic_load_n (&cond->seq, __ATOMIC_RELAXED);
+  pthread_mutex_unlock (mutex);
+  _futex_wait (&cond->seq, seq);
+  // Other waiters may have been woken with us, so relock in the 
+  //   'waiters' state, to be sure that unlock wakes the next one
+  while (__atomic_exchange_n (&mutex->lock, 2, __ATOMIC_ACQUIRE) != 0)
+    _futex_wait (&mutex->lock, 2);
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_cond_signal, pthread_cond_broadcast 
+
+===========================================================================*/
+int pthread_cond_signal (pthread_cond_t *cond)
+  {
+  __atomic_fetch_add (&cond->seq, 1, __ATOMIC_RELEASE);
+  _futex_wake (&cond->seq, 1);
+  return 0;
+  }
+
+int pthread_cond_broadcast (pthread_cond_t *cond)
+  {
+  __atomic_fetch_add (&cond->seq, 1, __ATOMIC_RELEASE);
+  _futex_wake (&cond->seq, 0x7fffffff);
+  return 0;
+  }
+
+/*===========================================================================
+
+  pthread_once 
+
+  The once control is 0 before the call, 1 while fn is running, and
+  2 afterwards.
+
+===========================================================================*/
+int pthread_once (pthread_once_t *once, void (*fn) (void))
+  {
+  if (__atomic_load_n (once, __ATOMIC_ACQUIRE) == 2) return 0;
+
+  int c = 0;
+  if (__atomic_compare_exchange_n (once, &c, 1, FALSE, 
+        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+    fn ();
+    __atomic_store_n (once, 2, __ATOMIC_RELEASE);
+    _futex_wake (once, 0x7fffffff);
+    return 0;
+    }
+
+  while (__atomic_load_n (once, __ATOMIC_ACQUIRE) == 1)
+    _futex_wait (once, 1);
+  return 0;
+  }
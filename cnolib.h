@@ -62,6 +62,7 @@ typedef unsigned int            uintptr_t;
 #endif
 
 typedef int pid_t;
+typedef long off_t;
 struct rusage;
 
 // syscall codes -- note that these are arch-specific
@@ -78,6 +79,13 @@ struct rusage;
 #define SYS_WAIT4       61
 #define SYS_CHDIR       80
 #define SYS_NANOSLEEP   35
+#define SYS_ARCH_PRCTL  158
+#define SYS_MMAP        9
+#define SYS_MUNMAP      11
+#define SYS_SCHED_YIELD 24
+#define SYS_CLONE       56
+#define SYS_FUTEX       202
+#define SYS_EXIT_GROUP  231
 // TODO add the rest
 #endif
 #ifdef __arm__
@@ -93,6 +101,13 @@ struct rusage;
 #define SYS_WAIT4       0x72
 #define SYS_CHDIR       12
 #define SYS_NANOSLEEP   162
+#define SYS_SET_TLS     0xf0005
+#define SYS_MMAP2       192
+#define SYS_MUNMAP      91
+#define SYS_SCHED_YIELD 158
+#define SYS_CLONE       120
+#define SYS_FUTEX       240
+#define SYS_EXIT_GROUP  248
 #endif
 // TODO add other architectures
 
@@ -108,6 +123,29 @@ struct rusage;
 #define O_APPEND        00002000
 #define O_NONBLOCK      00004000
 
+// Memory mapping constants
+#define PROT_NONE       0x0
+#define PROT_READ       0x1
+#define PROT_WRITE      0x2
+#define PROT_EXEC       0x4
+#define MAP_SHARED      0x01
+#define MAP_PRIVATE     0x02
+#define MAP_FIXED       0x10
+#define MAP_ANONYMOUS   0x20
+#define MAP_STACK       0x20000
+#define MAP_FAILED      ((void *) -1)
+
+// clone() flags
+#define CLONE_VM             0x00000100
+#define CLONE_FS             0x00000200
+#define CLONE_FILES          0x00000400
+#define CLONE_SIGHAND        0x00000800
+#define CLONE_THREAD         0x00010000
+#define CLONE_SYSVSEM        0x00040000
+#define CLONE_SETTLS         0x00080000
+#define CLONE_PARENT_SETTID  0x00100000
+#define CLONE_CHILD_CLEARTID 0x00200000
+
 // File status constants
 #define R_OK            4
 #define W_OK            2
@@ -152,10 +190,20 @@ struct rusage;
 #define	ERANGE		34	/* Math result not representable */
 
 // These global variables have the same meaning here as they do
-//  in traditional standard libraries
-extern int errno;
+//  in traditional standard libraries. errno is per-thread, and is only
+//  usable after __main() has set up the thread pointer
+extern __thread int errno;
 extern char **envp;
 
+// Auxiliary vector entry types, for getauxval()
+#define AT_NULL         0
+#define AT_PHDR         3
+#define AT_PHENT        4
+#define AT_PHNUM        5
+#define AT_PAGESZ       6
+#define AT_ENTRY        9
+#define AT_RANDOM       25
+
 // Note this SWAP implementation only works (I think) with gcc
 #define SWAP(x, y) do { typeof(x) SWAP = x; x = y; y = SWAP; } while (0)
 
@@ -169,7 +217,11 @@ extern int      sys_read (int fd, const void *, int l);
 extern int      sys_brk (unsigned long brk);
 extern int      sys_open (const char *pathname, int flags,...);
 extern int      sys_close (int fd);
-extern int      syscall (int number,...);
+// syscall() returns a long, because some calls (brk, mmap) return
+//  addresses that don't fit into an int on 64-bit platforms
+extern long     syscall (long number,...);
+extern int      __clone (int (*fn)(void *), void *stack, int flags, 
+                  void *arg, int *ptid, void *tls, int *ctid);
 
 /* Fundamental platform functions */
 extern int      chdir (const char *dir); 
@@ -181,6 +233,7 @@ extern int      execv (const char *filename, char *const argv[]);
 extern int      execvp (const char *filename, char *const argv[]);
 extern int      fork (void);
 extern pid_t    waitpid (pid_t pid, int *wstatus, int options);
+extern unsigned long getauxval (unsigned long type);
 
 /* String handling functions */
 
@@ -253,6 +306,9 @@ extern void    *memmove (void *dest, const void *src, size_t n);
 extern void    *memset (void *s, int c, size_t n);
 extern void    *memchr(const void *s, int c, size_t n);
 extern void    *rawmemchr(const void *s, int c);
+extern void    *mmap (void *addr, size_t length, int prot, int flags, 
+                  int fd, off_t offset);
+extern int      munmap (void *addr, size_t length);
 
 /* Error handling */
 extern void     perror (const char *message);
@@ -275,6 +331,60 @@ struct timespec
 extern int nanosleep (const struct timespec *req, struct timespec *rem);
 extern unsigned int sleep (unsigned int sec);
 
+/* Threads 
+
+   A small subset of POSIX threads, built directly on clone() and futex().
+   Attributes other than the stack size are not supported. Buffered
+   I/O (FILE) is not thread-safe; everything else in this library either
+   keeps its state per-thread, or locks it. */
+
+struct _pthread;
+typedef struct _pthread *pthread_t;
+
+typedef struct 
+  {
+  size_t stacksize;
+  } pthread_attr_t;
+
+typedef struct 
+  {
+  int lock;
+  } pthread_mutex_t;
+
+typedef struct 
+  {
+  int seq;
+  } pthread_cond_t;
+
+typedef int pthread_once_t;
+
+#define PTHREAD_MUTEX_INITIALIZER { 0 }
+#define PTHREAD_COND_INITIALIZER { 0 }
+#define PTHREAD_ONCE_INIT 0
+
+extern int       pthread_attr_init (pthread_attr_t *attr);
+extern int       pthread_attr_setstacksize (pthread_attr_t *attr, 
+                   size_t stacksize);
+extern int       pthread_create (pthread_t *thread, 
+                   const pthread_attr_t *attr, 
+                   void *(*start_routine) (void *), void *arg);
+extern int       pthread_join (pthread_t thread, void **retval);
+extern void      pthread_exit (void *retval);
+extern pthread_t pthread_self (void);
+extern int       pthread_mutex_init (pthread_mutex_t *mutex, const void *attr);
+extern int       pthread_mutex_destroy (pthread_mutex_t *mutex);
+extern int       pthread_mutex_lock (pthread_mutex_t *mutex);
+extern int       pthread_mutex_trylock (pthread_mutex_t *mutex);
+extern int       pthread_mutex_unlock (pthread_mutex_t *mutex);
+extern int       pthread_cond_init (pthread_cond_t *cond, const void *attr);
+extern int       pthread_cond_destroy (pthread_cond_t *cond);
+extern int       pthread_cond_wait (pthread_cond_t *cond, 
+                   pthread_mutex_t *mutex);
+extern int       pthread_cond_signal (pthread_cond_t *cond);
+extern int       pthread_cond_broadcast (pthread_cond_t *cond);
+extern int       pthread_once (pthread_once_t *once, void (*fn) (void));
+extern int       sched_yield (void);
+
 /* Private and debugging functions */
 
 extern void   _cnolib_dump_mem_blocks (void);